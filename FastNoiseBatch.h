@@ -0,0 +1,407 @@
+// Batch evaluation on top of FastNoiseLite.h, for filling whole chunk grids in one call.
+//
+// fnlGetNoise3DBatch and fnlDomainWarp3DBatch take arrays of points and give the exact same
+// floats as calling fnlGetNoise3D / fnlDomainWarp3D on every point. The paths chunk generation
+// uses are vectorised (AVX2 8 wide, SSE2 4 wide) :
+//   noise  : Perlin and Value, no fractal or FBm, FNL_ROTATION_NONE
+//   warp   : BasicGrid, single or progressive fractal, FNL_ROTATION_NONE
+// Anything else, and the tail of a batch, goes through the scalar functions.
+//
+// This header includes FastNoiseLite.h with FNL_IMPL itself, it needs the library's static
+// helpers and tables in the same translation unit.
+
+#ifndef FASTNOISEBATCH_H
+#define FASTNOISEBATCH_H
+
+// The scalar and vector paths only agree bit for bit if neither gets its mul+add fused
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#ifndef FNL_IMPL
+#define FNL_IMPL
+#endif
+#include "FastNoiseLite.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+#define FNLB_LANES 8
+typedef __m256 fnlb_f;
+typedef __m256i fnlb_i;
+#define fnlb_setf(a) _mm256_set1_ps(a)
+#define fnlb_seti(a) _mm256_set1_epi32(a)
+#define fnlb_loadf(p) _mm256_loadu_ps(p)
+#define fnlb_storef(p, a) _mm256_storeu_ps(p, a)
+#define fnlb_add(a, b) _mm256_add_ps(a, b)
+#define fnlb_sub(a, b) _mm256_sub_ps(a, b)
+#define fnlb_mul(a, b) _mm256_mul_ps(a, b)
+#define fnlb_itof(a) _mm256_cvtepi32_ps(a)
+#define fnlb_trunc(a) _mm256_cvttps_epi32(a)
+#define fnlb_ltzero(a) _mm256_castps_si256(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_LT_OQ))
+#define fnlb_addi(a, b) _mm256_add_epi32(a, b)
+#define fnlb_xori(a, b) _mm256_xor_si256(a, b)
+#define fnlb_andi(a, b) _mm256_and_si256(a, b)
+#define fnlb_ori(a, b) _mm256_or_si256(a, b)
+#define fnlb_srai(a, n) _mm256_srai_epi32(a, n)
+#define fnlb_slli(a, n) _mm256_slli_epi32(a, n)
+#define fnlb_muli(a, b) _mm256_mullo_epi32(a, b)
+#define fnlb_gather(t, i) _mm256_i32gather_ps(t, i, 4)
+
+#elif defined(__SSE2__)
+
+#include <emmintrin.h>
+#define FNLB_LANES 4
+typedef __m128 fnlb_f;
+typedef __m128i fnlb_i;
+#define fnlb_setf(a) _mm_set1_ps(a)
+#define fnlb_seti(a) _mm_set1_epi32(a)
+#define fnlb_loadf(p) _mm_loadu_ps(p)
+#define fnlb_storef(p, a) _mm_storeu_ps(p, a)
+#define fnlb_add(a, b) _mm_add_ps(a, b)
+#define fnlb_sub(a, b) _mm_sub_ps(a, b)
+#define fnlb_mul(a, b) _mm_mul_ps(a, b)
+#define fnlb_itof(a) _mm_cvtepi32_ps(a)
+#define fnlb_trunc(a) _mm_cvttps_epi32(a)
+#define fnlb_ltzero(a) _mm_castps_si128(_mm_cmplt_ps(a, _mm_setzero_ps()))
+#define fnlb_addi(a, b) _mm_add_epi32(a, b)
+#define fnlb_xori(a, b) _mm_xor_si128(a, b)
+#define fnlb_andi(a, b) _mm_and_si128(a, b)
+#define fnlb_ori(a, b) _mm_or_si128(a, b)
+#define fnlb_srai(a, n) _mm_srai_epi32(a, n)
+#define fnlb_slli(a, n) _mm_slli_epi32(a, n)
+
+// Low 32 bits of the product, same wrap around as the scalar int multiply
+static inline __m128i fnlb_muli(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+static inline __m128 fnlb_gather(const float *table, __m128i idx)
+{
+    int32_t i[4];
+    _mm_storeu_si128((__m128i *)i, idx);
+    return _mm_setr_ps(table[i[0]], table[i[1]], table[i[2]], table[i[3]]);
+}
+
+#endif
+
+#ifdef FNLB_LANES
+
+// Every helper below mirrors its scalar twin in FastNoiseLite.h operation for operation
+
+// _fnlFastFloor : truncate, minus one for negatives (so -2.0 gives -3, like the scalar one)
+static inline fnlb_i fnlb_floor(fnlb_f f) { return fnlb_addi(fnlb_trunc(f), fnlb_ltzero(f)); }
+
+static inline fnlb_f fnlb_lerp(fnlb_f a, fnlb_f b, fnlb_f t) { return fnlb_add(a, fnlb_mul(t, fnlb_sub(b, a))); }
+
+static inline fnlb_f fnlb_interpHermite(fnlb_f t)
+{
+    return fnlb_mul(fnlb_mul(t, t), fnlb_sub(fnlb_setf(3), fnlb_mul(fnlb_setf(2), t)));
+}
+
+static inline fnlb_f fnlb_interpQuintic(fnlb_f t)
+{
+    fnlb_f inner = fnlb_add(fnlb_mul(t, fnlb_sub(fnlb_mul(t, fnlb_setf(6)), fnlb_setf(15))), fnlb_setf(10));
+    return fnlb_mul(fnlb_mul(fnlb_mul(t, t), t), inner);
+}
+
+static inline fnlb_i fnlb_hash3D(fnlb_i seed, fnlb_i xPrimed, fnlb_i yPrimed, fnlb_i zPrimed)
+{
+    fnlb_i hash = fnlb_xori(fnlb_xori(fnlb_xori(seed, xPrimed), yPrimed), zPrimed);
+    return fnlb_muli(hash, fnlb_seti(0x27d4eb2d));
+}
+
+static inline fnlb_f fnlb_valCoord3D(fnlb_i seed, fnlb_i xPrimed, fnlb_i yPrimed, fnlb_i zPrimed)
+{
+    fnlb_i hash = fnlb_hash3D(seed, xPrimed, yPrimed, zPrimed);
+    hash = fnlb_muli(hash, hash);
+    hash = fnlb_xori(hash, fnlb_slli(hash, 19));
+    return fnlb_mul(fnlb_itof(hash), fnlb_setf(1 / 2147483648.0f));
+}
+
+static inline fnlb_f fnlb_gradCoord3D(fnlb_i seed, fnlb_i xPrimed, fnlb_i yPrimed, fnlb_i zPrimed, fnlb_f xd, fnlb_f yd, fnlb_f zd)
+{
+    fnlb_i hash = fnlb_hash3D(seed, xPrimed, yPrimed, zPrimed);
+    hash = fnlb_xori(hash, fnlb_srai(hash, 15));
+    hash = fnlb_andi(hash, fnlb_seti(63 << 2));
+    fnlb_f gx = fnlb_gather(GRADIENTS_3D, hash);
+    fnlb_f gy = fnlb_gather(GRADIENTS_3D, fnlb_ori(hash, fnlb_seti(1)));
+    fnlb_f gz = fnlb_gather(GRADIENTS_3D, fnlb_ori(hash, fnlb_seti(2)));
+    return fnlb_add(fnlb_add(fnlb_mul(xd, gx), fnlb_mul(yd, gy)), fnlb_mul(zd, gz));
+}
+
+static inline fnlb_f fnlb_singlePerlin3D(int seed, fnlb_f x, fnlb_f y, fnlb_f z)
+{
+    fnlb_i x0 = fnlb_floor(x);
+    fnlb_i y0 = fnlb_floor(y);
+    fnlb_i z0 = fnlb_floor(z);
+
+    fnlb_f xd0 = fnlb_sub(x, fnlb_itof(x0));
+    fnlb_f yd0 = fnlb_sub(y, fnlb_itof(y0));
+    fnlb_f zd0 = fnlb_sub(z, fnlb_itof(z0));
+    fnlb_f xd1 = fnlb_sub(xd0, fnlb_setf(1));
+    fnlb_f yd1 = fnlb_sub(yd0, fnlb_setf(1));
+    fnlb_f zd1 = fnlb_sub(zd0, fnlb_setf(1));
+
+    fnlb_f xs = fnlb_interpQuintic(xd0);
+    fnlb_f ys = fnlb_interpQuintic(yd0);
+    fnlb_f zs = fnlb_interpQuintic(zd0);
+
+    x0 = fnlb_muli(x0, fnlb_seti(PRIME_X));
+    y0 = fnlb_muli(y0, fnlb_seti(PRIME_Y));
+    z0 = fnlb_muli(z0, fnlb_seti(PRIME_Z));
+    fnlb_i x1 = fnlb_addi(x0, fnlb_seti(PRIME_X));
+    fnlb_i y1 = fnlb_addi(y0, fnlb_seti(PRIME_Y));
+    fnlb_i z1 = fnlb_addi(z0, fnlb_seti(PRIME_Z));
+
+    fnlb_i s = fnlb_seti(seed);
+    fnlb_f xf00 = fnlb_lerp(fnlb_gradCoord3D(s, x0, y0, z0, xd0, yd0, zd0), fnlb_gradCoord3D(s, x1, y0, z0, xd1, yd0, zd0), xs);
+    fnlb_f xf10 = fnlb_lerp(fnlb_gradCoord3D(s, x0, y1, z0, xd0, yd1, zd0), fnlb_gradCoord3D(s, x1, y1, z0, xd1, yd1, zd0), xs);
+    fnlb_f xf01 = fnlb_lerp(fnlb_gradCoord3D(s, x0, y0, z1, xd0, yd0, zd1), fnlb_gradCoord3D(s, x1, y0, z1, xd1, yd0, zd1), xs);
+    fnlb_f xf11 = fnlb_lerp(fnlb_gradCoord3D(s, x0, y1, z1, xd0, yd1, zd1), fnlb_gradCoord3D(s, x1, y1, z1, xd1, yd1, zd1), xs);
+
+    fnlb_f yf0 = fnlb_lerp(xf00, xf10, ys);
+    fnlb_f yf1 = fnlb_lerp(xf01, xf11, ys);
+
+    return fnlb_mul(fnlb_lerp(yf0, yf1, zs), fnlb_setf(0.964921414852142333984375f));
+}
+
+static inline fnlb_f fnlb_singleValue3D(int seed, fnlb_f x, fnlb_f y, fnlb_f z)
+{
+    fnlb_i x0 = fnlb_floor(x);
+    fnlb_i y0 = fnlb_floor(y);
+    fnlb_i z0 = fnlb_floor(z);
+
+    fnlb_f xs = fnlb_interpHermite(fnlb_sub(x, fnlb_itof(x0)));
+    fnlb_f ys = fnlb_interpHermite(fnlb_sub(y, fnlb_itof(y0)));
+    fnlb_f zs = fnlb_interpHermite(fnlb_sub(z, fnlb_itof(z0)));
+
+    x0 = fnlb_muli(x0, fnlb_seti(PRIME_X));
+    y0 = fnlb_muli(y0, fnlb_seti(PRIME_Y));
+    z0 = fnlb_muli(z0, fnlb_seti(PRIME_Z));
+    fnlb_i x1 = fnlb_addi(x0, fnlb_seti(PRIME_X));
+    fnlb_i y1 = fnlb_addi(y0, fnlb_seti(PRIME_Y));
+    fnlb_i z1 = fnlb_addi(z0, fnlb_seti(PRIME_Z));
+
+    fnlb_i s = fnlb_seti(seed);
+    fnlb_f xf00 = fnlb_lerp(fnlb_valCoord3D(s, x0, y0, z0), fnlb_valCoord3D(s, x1, y0, z0), xs);
+    fnlb_f xf10 = fnlb_lerp(fnlb_valCoord3D(s, x0, y1, z0), fnlb_valCoord3D(s, x1, y1, z0), xs);
+    fnlb_f xf01 = fnlb_lerp(fnlb_valCoord3D(s, x0, y0, z1), fnlb_valCoord3D(s, x1, y0, z1), xs);
+    fnlb_f xf11 = fnlb_lerp(fnlb_valCoord3D(s, x0, y1, z1), fnlb_valCoord3D(s, x1, y1, z1), xs);
+
+    fnlb_f yf0 = fnlb_lerp(xf00, xf10, ys);
+    fnlb_f yf1 = fnlb_lerp(xf01, xf11, ys);
+
+    return fnlb_lerp(yf0, yf1, zs);
+}
+
+static inline fnlb_f fnlb_genNoiseSingle3D(fnl_state *state, int seed, fnlb_f x, fnlb_f y, fnlb_f z)
+{
+    if (state->noise_type == FNL_NOISE_PERLIN)
+        return fnlb_singlePerlin3D(seed, x, y, z);
+    return fnlb_singleValue3D(seed, x, y, z);
+}
+
+static inline fnlb_f fnlb_genFractalFBM3D(fnl_state *state, fnlb_f x, fnlb_f y, fnlb_f z)
+{
+    int seed = state->seed;
+    fnlb_f sum = fnlb_setf(0);
+    fnlb_f amp = fnlb_setf(_fnlCalculateFractalBounding(state));
+
+    for (int i = 0; i < state->octaves; i++)
+    {
+        fnlb_f noise = fnlb_genNoiseSingle3D(state, seed++, x, y, z);
+        sum = fnlb_add(sum, fnlb_mul(noise, amp));
+        amp = fnlb_mul(amp, fnlb_lerp(fnlb_setf(1.0f), fnlb_mul(fnlb_add(noise, fnlb_setf(1)), fnlb_setf(0.5f)), fnlb_setf(state->weighted_strength)));
+
+        x = fnlb_mul(x, fnlb_setf(state->lacunarity));
+        y = fnlb_mul(y, fnlb_setf(state->lacunarity));
+        z = fnlb_mul(z, fnlb_setf(state->lacunarity));
+        amp = fnlb_mul(amp, fnlb_setf(state->gain));
+    }
+
+    return sum;
+}
+
+static inline void fnlb_singleDomainWarpBasicGrid3D(int seed, float warpAmp, float frequency, fnlb_f x, fnlb_f y, fnlb_f z, fnlb_f *xp, fnlb_f *yp, fnlb_f *zp)
+{
+    fnlb_f xf = fnlb_mul(x, fnlb_setf(frequency));
+    fnlb_f yf = fnlb_mul(y, fnlb_setf(frequency));
+    fnlb_f zf = fnlb_mul(z, fnlb_setf(frequency));
+
+    fnlb_i x0 = fnlb_floor(xf);
+    fnlb_i y0 = fnlb_floor(yf);
+    fnlb_i z0 = fnlb_floor(zf);
+
+    fnlb_f xs = fnlb_interpHermite(fnlb_sub(xf, fnlb_itof(x0)));
+    fnlb_f ys = fnlb_interpHermite(fnlb_sub(yf, fnlb_itof(y0)));
+    fnlb_f zs = fnlb_interpHermite(fnlb_sub(zf, fnlb_itof(z0)));
+
+    x0 = fnlb_muli(x0, fnlb_seti(PRIME_X));
+    y0 = fnlb_muli(y0, fnlb_seti(PRIME_Y));
+    z0 = fnlb_muli(z0, fnlb_seti(PRIME_Z));
+    fnlb_i x1 = fnlb_addi(x0, fnlb_seti(PRIME_X));
+    fnlb_i y1 = fnlb_addi(y0, fnlb_seti(PRIME_Y));
+    fnlb_i z1 = fnlb_addi(z0, fnlb_seti(PRIME_Z));
+
+    fnlb_i s = fnlb_seti(seed);
+    fnlb_i mask = fnlb_seti(255 << 2);
+    fnlb_i one = fnlb_seti(1);
+    fnlb_i two = fnlb_seti(2);
+
+    fnlb_i idx0 = fnlb_andi(fnlb_hash3D(s, x0, y0, z0), mask);
+    fnlb_i idx1 = fnlb_andi(fnlb_hash3D(s, x1, y0, z0), mask);
+
+    fnlb_f lx0x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, idx0), fnlb_gather(RAND_VECS_3D, idx1), xs);
+    fnlb_f ly0x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, one)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, one)), xs);
+    fnlb_f lz0x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, two)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, two)), xs);
+
+    idx0 = fnlb_andi(fnlb_hash3D(s, x0, y1, z0), mask);
+    idx1 = fnlb_andi(fnlb_hash3D(s, x1, y1, z0), mask);
+
+    fnlb_f lx1x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, idx0), fnlb_gather(RAND_VECS_3D, idx1), xs);
+    fnlb_f ly1x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, one)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, one)), xs);
+    fnlb_f lz1x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, two)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, two)), xs);
+
+    fnlb_f lx0y = fnlb_lerp(lx0x, lx1x, ys);
+    fnlb_f ly0y = fnlb_lerp(ly0x, ly1x, ys);
+    fnlb_f lz0y = fnlb_lerp(lz0x, lz1x, ys);
+
+    idx0 = fnlb_andi(fnlb_hash3D(s, x0, y0, z1), mask);
+    idx1 = fnlb_andi(fnlb_hash3D(s, x1, y0, z1), mask);
+
+    lx0x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, idx0), fnlb_gather(RAND_VECS_3D, idx1), xs);
+    ly0x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, one)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, one)), xs);
+    lz0x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, two)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, two)), xs);
+
+    idx0 = fnlb_andi(fnlb_hash3D(s, x0, y1, z1), mask);
+    idx1 = fnlb_andi(fnlb_hash3D(s, x1, y1, z1), mask);
+
+    lx1x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, idx0), fnlb_gather(RAND_VECS_3D, idx1), xs);
+    ly1x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, one)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, one)), xs);
+    lz1x = fnlb_lerp(fnlb_gather(RAND_VECS_3D, fnlb_ori(idx0, two)), fnlb_gather(RAND_VECS_3D, fnlb_ori(idx1, two)), xs);
+
+    fnlb_f amp = fnlb_setf(warpAmp);
+    *xp = fnlb_add(*xp, fnlb_mul(fnlb_lerp(lx0y, fnlb_lerp(lx0x, lx1x, ys), zs), amp));
+    *yp = fnlb_add(*yp, fnlb_mul(fnlb_lerp(ly0y, fnlb_lerp(ly0x, ly1x, ys), zs), amp));
+    *zp = fnlb_add(*zp, fnlb_mul(fnlb_lerp(lz0y, fnlb_lerp(lz0x, lz1x, ys), zs), amp));
+}
+
+#endif // FNLB_LANES
+
+static inline bool _fnlBatchNoise3DVectorised(fnl_state *state)
+{
+    return state->rotation_type_3d == FNL_ROTATION_NONE &&
+           (state->noise_type == FNL_NOISE_PERLIN || state->noise_type == FNL_NOISE_VALUE) &&
+           state->fractal_type != FNL_FRACTAL_RIDGED && state->fractal_type != FNL_FRACTAL_PINGPONG;
+}
+
+static inline bool _fnlBatchWarp3DVectorised(fnl_state *state)
+{
+    return state->rotation_type_3d == FNL_ROTATION_NONE &&
+           state->domain_warp_type == FNL_DOMAIN_WARP_BASICGRID &&
+           state->fractal_type != FNL_FRACTAL_DOMAIN_WARP_INDEPENDENT;
+}
+
+/**
+ * out[i] = fnlGetNoise3D(state, x[i], y[i], z[i]) for i in [0, count)
+ */
+static void fnlGetNoise3DBatch(fnl_state *state, const FNLfloat *x, const FNLfloat *y, const FNLfloat *z, float *out, int count)
+{
+    int i = 0;
+#ifdef FNLB_LANES
+    if (_fnlBatchNoise3DVectorised(state))
+    {
+        fnlb_f freq = fnlb_setf(state->frequency);
+        for (; i + FNLB_LANES <= count; i += FNLB_LANES)
+        {
+            // _fnlTransformNoiseCoordinate3D without rotation is only the frequency
+            fnlb_f xv = fnlb_mul(fnlb_loadf(x + i), freq);
+            fnlb_f yv = fnlb_mul(fnlb_loadf(y + i), freq);
+            fnlb_f zv = fnlb_mul(fnlb_loadf(z + i), freq);
+            if (state->fractal_type == FNL_FRACTAL_FBM)
+                fnlb_storef(out + i, fnlb_genFractalFBM3D(state, xv, yv, zv));
+            else
+                fnlb_storef(out + i, fnlb_genNoiseSingle3D(state, state->seed, xv, yv, zv));
+        }
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = fnlGetNoise3D(state, x[i], y[i], z[i]);
+}
+
+/**
+ * fnlDomainWarp3D(state, &x[i], &y[i], &z[i]) for i in [0, count)
+ */
+static void fnlDomainWarp3DBatch(fnl_state *state, FNLfloat *x, FNLfloat *y, FNLfloat *z, int count)
+{
+    int i = 0;
+#ifdef FNLB_LANES
+    if (_fnlBatchWarp3DVectorised(state))
+    {
+        int octaves = state->fractal_type == FNL_FRACTAL_DOMAIN_WARP_PROGRESSIVE ? state->octaves : 1;
+        float amp0 = state->domain_warp_amp * _fnlCalculateFractalBounding(state);
+        for (; i + FNLB_LANES <= count; i += FNLB_LANES)
+        {
+            fnlb_f xv = fnlb_loadf(x + i);
+            fnlb_f yv = fnlb_loadf(y + i);
+            fnlb_f zv = fnlb_loadf(z + i);
+            int seed = state->seed;
+            float amp = amp0;
+            float freq = state->frequency;
+            for (int o = 0; o < octaves; o++)
+            {
+                // BasicGrid without rotation leaves the warp coordinate as is
+                fnlb_singleDomainWarpBasicGrid3D(seed, amp, freq, xv, yv, zv, &xv, &yv, &zv);
+                seed++;
+                amp *= state->gain;
+                freq *= state->lacunarity;
+            }
+            fnlb_storef(x + i, xv);
+            fnlb_storef(y + i, yv);
+            fnlb_storef(z + i, zv);
+        }
+    }
+#endif
+    for (; i < count; i++)
+        fnlDomainWarp3D(state, &x[i], &y[i], &z[i]);
+}
+
+/**
+ * out[i*ny + j] = fnlGetNoise2D(state, x0 + i, y0 + j)
+ * OpenSimplex2 is not vectorised, a 2D grid is a small part of a chunk anyway.
+ */
+static void fnlGetNoise2DGrid(fnl_state *state, float *out, int64_t x0, int64_t y0, int nx, int ny)
+{
+    for (int i = 0; i < nx; i++)
+        for (int j = 0; j < ny; j++)
+            out[i * ny + j] = fnlGetNoise2D(state, (FNLfloat)(x0 + i), (FNLfloat)(y0 + j));
+}
+
+/**
+ * Point coordinates of an nx*ny*nz grid starting at (x0,y0,z0), point (i,j,k) at (i*ny + j)*nz + k
+ */
+static void fnlFillGrid3D(FNLfloat *x, FNLfloat *y, FNLfloat *z, int64_t x0, int64_t y0, int64_t z0, int nx, int ny, int nz)
+{
+    for (int i = 0; i < nx; i++)
+        for (int j = 0; j < ny; j++)
+            for (int k = 0; k < nz; k++)
+            {
+                int n = (i * ny + j) * nz + k;
+                x[n] = (FNLfloat)(x0 + i);
+                y[n] = (FNLfloat)(y0 + j);
+                z[n] = (FNLfloat)(z0 + k);
+            }
+}
+
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // FASTNOISEBATCH_H
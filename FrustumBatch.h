@@ -0,0 +1,112 @@
+// Batch frustum tests for axis aligned cubes, used to cull chunks and octree nodes.
+//
+// frustumCullCubes tests `count` cubes given as arrays of their min corner and side against six
+// planes {nx,ny,nz,d}, a point being inside a plane when nx*x + ny*y + nz*z + d >= 0. A cube is
+// out when its corner furthest along the normal of some plane is behind it, that corner's
+// distance being n.min + d + s*(max(nx,0) + max(ny,0) + max(nz,0)). Cubes crossing a corner of
+// the frustum can pass while out, never the other way around.
+//
+// AVX 8 cubes at a time, SSE 4, the tail of a batch goes through the scalar test. The
+// operations are done in the same order on every path so they give the same answers.
+
+#ifndef FRUSTUMBATCH_H
+#define FRUSTUMBATCH_H
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#if defined(__AVX__)
+
+#include <immintrin.h>
+#define FRB_LANES 8
+typedef __m256 frb_f;
+#define frb_zero() _mm256_setzero_ps()
+#define frb_setf(a) _mm256_set1_ps(a)
+#define frb_loadf(p) _mm256_loadu_ps(p)
+#define frb_add(a, b) _mm256_add_ps(a, b)
+#define frb_mul(a, b) _mm256_mul_ps(a, b)
+#define frb_ltzero(a) _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_LT_OQ)
+#define frb_or(a, b) _mm256_or_ps(a, b)
+#define frb_mask(a) _mm256_movemask_ps(a)
+
+#elif defined(__SSE__) || defined(_M_X64)
+
+#include <xmmintrin.h>
+#define FRB_LANES 4
+typedef __m128 frb_f;
+#define frb_zero() _mm_setzero_ps()
+#define frb_setf(a) _mm_set1_ps(a)
+#define frb_loadf(p) _mm_loadu_ps(p)
+#define frb_add(a, b) _mm_add_ps(a, b)
+#define frb_mul(a, b) _mm_mul_ps(a, b)
+#define frb_ltzero(a) _mm_cmplt_ps(a, _mm_setzero_ps())
+#define frb_or(a, b) _mm_or_ps(a, b)
+#define frb_mask(a) _mm_movemask_ps(a)
+
+#endif
+
+static inline float frustumPlaneReach(const float *plane)
+{
+    return (plane[0] > 0 ? plane[0] : 0.0f) + (plane[1] > 0 ? plane[1] : 0.0f) + (plane[2] > 0 ? plane[2] : 0.0f);
+}
+
+static inline int frustumCubeVisible(const float *planes, float x, float y, float z, float s)
+{
+    for (int p = 0; p < 6; p++)
+    {
+        const float *pl = planes + p*4;
+        float dist = pl[0]*x + pl[1]*y + pl[2]*z + pl[3] + frustumPlaneReach(pl)*s;
+        if (dist < 0) return 0;
+    }
+    return 1;
+}
+
+// visible[i] is set to 1 or 0, returns how many are visible
+static int frustumCullCubes(const float *planes, const float *x, const float *y, const float *z, const float *s,
+                            unsigned char *visible, int count)
+{
+    int i = 0, seen = 0;
+#ifdef FRB_LANES
+    frb_f nx[6], ny[6], nz[6], d[6], reach[6];
+    for (int p = 0; p < 6; p++)
+    {
+        nx[p] = frb_setf(planes[p*4]);
+        ny[p] = frb_setf(planes[p*4 + 1]);
+        nz[p] = frb_setf(planes[p*4 + 2]);
+        d[p] = frb_setf(planes[p*4 + 3]);
+        reach[p] = frb_setf(frustumPlaneReach(planes + p*4));
+    }
+    for (; i + FRB_LANES <= count; i += FRB_LANES)
+    {
+        frb_f bx = frb_loadf(x + i), by = frb_loadf(y + i), bz = frb_loadf(z + i), bs = frb_loadf(s + i);
+        frb_f out = frb_zero();
+        for (int p = 0; p < 6; p++)
+        {
+            frb_f dist = frb_add(frb_add(frb_add(frb_add(frb_mul(nx[p], bx), frb_mul(ny[p], by)), frb_mul(nz[p], bz)), d[p]), frb_mul(reach[p], bs));
+            out = frb_or(out, frb_ltzero(dist));
+        }
+        int mask = frb_mask(out);
+        for (int l = 0; l < FRB_LANES; l++)
+        {
+            visible[i + l] = !((mask >> l) & 1);
+            seen += visible[i + l];
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        visible[i] = (unsigned char)frustumCubeVisible(planes, x[i], y[i], z[i], s[i]);
+        seen += visible[i];
+    }
+    return seen;
+}
+
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // FRUSTUMBATCH_H
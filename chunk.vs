@@ -0,0 +1,93 @@
+#version 120
+
+// Input vertex attributes
+// Packed chunk vertex (see meshStruct.nelua), 4 unnormalised bytes :
+// x | normal bits 0-1 << 6, y | normal bit 2 << 6, z, atlas tile id
+attribute vec4 vertexPacked;
+// Sky light, block light (0-15), ambient occlusion of the corner (0-3), unused
+attribute vec4 vertexShade;
+// Slot of the chunk in its batch page, 0 for meshes drawn on their own
+attribute float vertexSlot;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform mat4 matModel;
+uniform vec2 tileSize;      // one atlas tile in uv units
+uniform float tilesPerRow;
+uniform vec4 chunkOrigins[64]; // xyz : chunk position, w : 0 when the slot is not drawn this frame
+
+// Output vertex attributes (to fragment shader)
+varying vec3 fragPosition;
+varying vec2 fragTexCoord;
+varying vec2 fragTileOrigin;
+varying vec4 fragColor;
+varying vec3 fragNormal;
+
+// NOTE: Add here your custom variables
+
+// https://github.com/glslify/glsl-inverse
+mat3 inverse(mat3 m)
+{
+  float a00 = m[0][0], a01 = m[0][1], a02 = m[0][2];
+  float a10 = m[1][0], a11 = m[1][1], a12 = m[1][2];
+  float a20 = m[2][0], a21 = m[2][1], a22 = m[2][2];
+
+  float b01 = a22*a11 - a12*a21;
+  float b11 = -a22*a10 + a12*a20;
+  float b21 = a21*a10 - a11*a20;
+
+  float det = a00*b01 + a01*b11 + a02*b21;
+
+  return mat3(b01, (-a22*a01 + a02*a21), (a12*a01 - a02*a11),
+              b11, (a22*a00 - a02*a20), (-a12*a00 + a02*a10),
+              b21, (-a21*a00 + a01*a20), (a11*a00 - a01*a10))/det;
+}
+
+// https://github.com/glslify/glsl-transpose
+mat3 transpose(mat3 m)
+{
+  return mat3(m[0][0], m[1][0], m[2][0],
+              m[0][1], m[1][1], m[2][1],
+              m[0][2], m[1][2], m[2][2]);
+}
+
+void main()
+{
+    // Unpack position, normal id and tile id
+    float normalLo = floor(vertexPacked.x/64.0);
+    float normalHi = floor(vertexPacked.y/64.0);
+    vec3 vertexPosition = vec3(vertexPacked.x - normalLo*64.0, vertexPacked.y - normalHi*64.0, vertexPacked.z);
+    float normalId = normalLo + normalHi*4.0;
+    float axis = floor(normalId/2.0);
+    float side = (normalId - axis*2.0)*2.0 - 1.0;
+    vec3 vertexNormal = vec3(0.0);
+    if (axis < 0.5) vertexNormal.x = side;
+    else if (axis < 1.5) vertexNormal.y = side;
+    else vertexNormal.z = side;
+
+    // Position projected on the face, repeated inside the tile by chunk.fs
+    if (axis < 0.5) fragTexCoord = vec2(vertexPosition.z, -vertexPosition.y);
+    else if (axis < 1.5) fragTexCoord = vec2(vertexPosition.x, vertexPosition.z);
+    else fragTexCoord = vec2(vertexPosition.x, -vertexPosition.y);
+    float tileRow = floor(vertexPacked.w/tilesPerRow);
+    fragTileOrigin = vec2(vertexPacked.w - tileRow*tilesPerRow, tileRow)*tileSize;
+
+    vec4 origin = chunkOrigins[int(vertexSlot + 0.5)];
+    vec3 position = vertexPosition + origin.xyz;
+
+    // Send vertex attributes to fragment shader
+    fragPosition = vec3(matModel*vec4(position, 1.0));
+    // Each light level below 15 is 20% darker, block light a little warmer than the sky
+    float skyLight = pow(0.8, 15.0 - vertexShade.x);
+    float blockLight = pow(0.8, 15.0 - vertexShade.y);
+    vec3 light = max(vec3(skyLight), vec3(1.0, 0.9, 0.75)*blockLight);
+    fragColor = vec4(light*(0.4 + 0.2*vertexShade.z), 1.0);
+
+    mat3 normalMatrix = transpose(inverse(mat3(matModel)));
+    fragNormal = normalize(normalMatrix*vertexNormal);
+
+    // Calculate final vertex position
+    gl_Position = mvp*vec4(position, 1.0);
+    // Hidden slots land past the far plane, their triangles are clipped before rasterisation
+    if (origin.w < 0.5) gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+}
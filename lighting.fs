@@ -3,6 +3,7 @@
 // Input vertex attributes (from vertex shader)
 varying vec3 fragPosition;
 varying vec2 fragTexCoord;
+varying vec2 fragTileOrigin;
 varying vec4 fragColor;
 varying vec3 fragNormal;
 
@@ -10,6 +11,10 @@ varying vec3 fragNormal;
 uniform sampler2D texture0;
 uniform vec4 colDiffuse;
 
+// Greedy chunk meshes : fragTexCoord is the position on the face, repeated inside the atlas tile
+uniform int tiledUV;
+uniform vec2 tileSize;
+
 // NOTE: Add here your custom variables
 
 #define     MAX_LIGHTS              4
@@ -32,7 +37,9 @@ uniform vec3 viewPos;
 void main()
 {
     // Texel color fetching from texture sampler
-    vec4 texelColor = texture2D(texture0, fragTexCoord);
+    vec2 uv = fragTexCoord;
+    if (tiledUV == 1) uv = fragTileOrigin + fract(fragTexCoord)*tileSize;
+    vec4 texelColor = texture2D(texture0, uv);
     vec3 lightDot = vec3(0.0);
     vec3 normal = normalize(fragNormal);
     vec3 viewD = normalize(viewPos - fragPosition);
@@ -3,6 +3,7 @@
 // Input vertex attributes
 attribute vec3 vertexPosition;
 attribute vec2 vertexTexCoord;
+attribute vec2 vertexTexCoord2;
 attribute vec3 vertexNormal;
 attribute vec4 vertexColor;
 
@@ -13,6 +14,7 @@ uniform mat4 matModel;
 // Output vertex attributes (to fragment shader)
 varying vec3 fragPosition;
 varying vec2 fragTexCoord;
+varying vec2 fragTileOrigin;
 varying vec4 fragColor;
 varying vec3 fragNormal;
 
@@ -49,6 +51,7 @@ void main()
     // Send vertex attributes to fragment shader
     fragPosition = vec3(matModel*vec4(vertexPosition, 1.0));
     fragTexCoord = vertexTexCoord;
+    fragTileOrigin = vertexTexCoord2;
     fragColor = vertexColor;
 
     mat3 normalMatrix = transpose(inverse(mat3(matModel)));